@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 
 template <typename Type>
 class ArrayPtr {
@@ -17,7 +18,7 @@ public:
             raw_ptr_ = nullptr;
         }
         else {
-            Type* new_ptr = new Type[size * sizeof(Type)];
+            Type* new_ptr = new Type[size];
             raw_ptr_ = new_ptr;
         }
     }
@@ -43,9 +44,12 @@ public:
     //  
     ArrayPtr& operator=(const ArrayPtr&) = delete;
 
+    //      other
     ArrayPtr& operator=(ArrayPtr&& other) noexcept {
-        raw_ptr_ = other.raw_ptr_;
-        other.raw_ptr_ = nullptr;
+        if (this != &other) {
+            ArrayPtr temp_ptr(std::move(other));
+            swap(temp_ptr);
+        }
 
         return *this;
     }
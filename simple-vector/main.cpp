@@ -1,8 +1,10 @@
 #include "simple_vector.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <numeric>
+#include <stdexcept>
 
 using namespace std;
 
@@ -149,6 +151,137 @@ void TestNoncopiableErase() {
     cout << "Done!" << endl << endl;
 }
 
+void TestBoolVectorModifiers() {
+    cout << "Test bool vector modifiers" << endl;
+    SimpleVector<bool> inserted;
+    //       
+    auto inserted_it = inserted.Insert(inserted.end(), true);
+    assert(*inserted_it && inserted.GetSize() == 1 && inserted.GetCapacity() == 64);
+    inserted[0].Flip();
+    assert(!inserted[0]);
+    inserted[0].Flip();
+    assert(inserted[0]);
+
+    SimpleVector<bool> v;
+    //    ,     
+    for (size_t i = 0; i < 130; ++i) {
+        v.PushBack(i % 3 == 0);
+    }
+    assert(v.GetSize() == 130);
+    assert(v.GetCapacity() >= 130);
+    for (size_t i = 0; i < v.GetSize(); ++i) {
+        assert(v[i] == (i % 3 == 0));
+    }
+
+    v.Insert(v.begin() + 1, true);
+    assert(v.GetSize() == 131);
+    assert(v[0] && v[1] && !v[2] && !v[3] && v[4]);
+    assert(v[130] == (129 % 3 == 0));
+
+    auto it = v.Erase(v.begin() + 1);
+    assert(*it == false);
+    assert(it != v.cend() && v.begin() == v.cbegin() && v.cend() - it == 129);
+    for (size_t i = 0; i < v.GetSize(); ++i) {
+        assert(v[i] == (i % 3 == 0));
+    }
+
+    v[1] = true;
+    v[0] = v[2];
+    assert(!v[0] && v[1]);
+
+    reverse(v.begin(), v.end());
+    for (size_t i = 0; i < v.GetSize(); ++i) {
+        assert(v[i] == (i == 128 || (i % 3 == 0 && i != 129)));
+    }
+    reverse(v.begin(), v.end());
+
+    v.Resize(65);
+    v.Resize(200);
+    assert(v.GetSize() == 200);
+    for (size_t i = 65; i < v.GetSize(); ++i) {
+        assert(!v[i]);
+    }
+
+    try {
+        v.At(200) = true;
+        assert(false);
+    }
+    catch (const out_of_range&) {
+    }
+    v.At(199) = true;
+    assert(v.At(199));
+
+    v.PopBack();
+    assert(v.GetSize() == 199);
+    v.Clear();
+    assert(v.IsEmpty());
+    cout << "Done!" << endl << endl;
+}
+
+void TestBoolVectorWordOperations() {
+    cout << "Test bool vector word operations" << endl;
+    const size_t size = 200;
+    SimpleVector<bool> evens(size);
+    SimpleVector<bool> thirds(size);
+    for (size_t i = 0; i < size; ++i) {
+        evens[i] = i % 2 == 0;
+        thirds[i] = i % 3 == 0;
+    }
+    assert(evens.Count() == 100);
+    assert(thirds.Count() == 67);
+    assert(SimpleVector<bool>(size, true).Count() == size);
+
+    SimpleVector<bool> sixths = evens & thirds;
+    assert(sixths.Count() == 34);
+    assert((evens | thirds).Count() == 133);
+    assert((evens ^ thirds).Count() == 99);
+
+    size_t found = 0;
+    for (size_t pos = sixths.FindFirst(); pos != SimpleVector<bool>::npos; pos = sixths.FindNext(pos)) {
+        assert(pos % 6 == 0);
+        ++found;
+    }
+    assert(found == 34);
+    assert(SimpleVector<bool>(size).FindFirst() == SimpleVector<bool>::npos);
+
+    //       
+    SimpleVector<bool> reserved(Reserve(65));
+    assert(reserved.IsEmpty() && reserved.GetCapacity() == 128);
+    reserved.Reserve(129);
+    assert(reserved.GetCapacity() == 192);
+
+    const SimpleVector<bool> listed = {true, false, true, true};
+    assert(listed.GetSize() == 4 && listed.Count() == 3);
+    assert(listed.At(0) && !listed.At(1));
+    try {
+        listed.At(4);
+        assert(false);
+    }
+    catch (const out_of_range&) {
+    }
+
+    SimpleVector<bool> copy(sixths);
+    assert(copy == sixths);
+    copy[199] = true;
+    assert(copy != sixths);
+
+    //    ,   filter = filter & mask
+    SimpleVector<bool> filter(size, true);
+    filter = filter & evens;
+    assert(filter == evens);
+    filter = move(copy);
+    assert(filter.GetSize() == size && filter[199]);
+
+    try {
+        filter &= SimpleVector<bool>(size + 1);
+        assert(false);
+    }
+    catch (const invalid_argument&) {
+    }
+    assert(filter.GetSize() == size && filter.Count() == 35);
+    cout << "Done!" << endl << endl;
+}
+
 int main() {
     TestTemporaryObjConstructor();
     TestTemporaryObjOperator();
@@ -158,5 +291,7 @@ int main() {
     TestNoncopiablePushBack();
     TestNoncopiableInsert();
     TestNoncopiableErase();
+    TestBoolVectorModifiers();
+    TestBoolVectorWordOperations();
     return 0;
 }
\ No newline at end of file
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
 #include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 #include "array_ptr.h"
 
@@ -372,6 +377,577 @@ private:
     size_t capacity_ = 0; //  
 };
 
+//   bool:        .
+//    size_   ,        
+template <>
+class SimpleVector<bool> {
+    using Word = uint64_t;
+    static constexpr size_t kWordBits = 64;
+
+public:
+    // ,  FindFirst/FindNext,     
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // -    
+    class Reference {
+    public:
+        Reference(Word* word, Word mask) noexcept
+            : word_(word), mask_(mask) {
+        }
+
+        operator bool() const noexcept {
+            return (*word_ & mask_) != 0;
+        }
+
+        Reference& operator=(bool value) noexcept {
+            if (value) {
+                *word_ |= mask_;
+            }
+            else {
+                *word_ &= ~mask_;
+            }
+            return *this;
+        }
+
+        Reference(const Reference&) noexcept = default;
+
+        //   ,    
+        Reference& operator=(const Reference& other) noexcept {
+            return *this = static_cast<bool>(other);
+        }
+
+        //  
+        void Flip() noexcept {
+            *word_ ^= mask_;
+        }
+
+        //   ,  std::iter_swap  -
+        friend void swap(Reference lhs, Reference rhs) noexcept {
+            bool tmp = lhs;
+            lhs = static_cast<bool>(rhs);
+            rhs = tmp;
+        }
+
+    private:
+        Word* word_;
+        Word mask_;
+    };
+
+    //      
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<IsConst, bool, Reference>;
+
+        BasicIterator() noexcept = default;
+
+        //      
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : words_(other.words_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            if constexpr (IsConst) {
+                return ((words_[index_ / kWordBits] >> (index_ % kWordBits)) & 1u) != 0;
+            }
+            else {
+                return Reference(words_ + index_ / kWordBits, Word(1) << (index_ % kWordBits));
+            }
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        BasicIterator operator+(difference_type n) const noexcept {
+            return BasicIterator(words_, index_ + n);
+        }
+
+        friend BasicIterator operator+(difference_type n, const BasicIterator& it) noexcept {
+            return it + n;
+        }
+
+        BasicIterator operator-(difference_type n) const noexcept {
+            return BasicIterator(words_, index_ - n);
+        }
+
+        //       
+        template <bool OtherConst>
+        difference_type operator-(const BasicIterator<OtherConst>& other) const noexcept {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        template <bool OtherConst>
+        bool operator==(const BasicIterator<OtherConst>& other) const noexcept {
+            return index_ == other.index_;
+        }
+
+        template <bool OtherConst>
+        bool operator!=(const BasicIterator<OtherConst>& other) const noexcept {
+            return index_ != other.index_;
+        }
+
+        template <bool OtherConst>
+        bool operator<(const BasicIterator<OtherConst>& other) const noexcept {
+            return index_ < other.index_;
+        }
+
+        template <bool OtherConst>
+        bool operator>(const BasicIterator<OtherConst>& other) const noexcept {
+            return index_ > other.index_;
+        }
+
+        template <bool OtherConst>
+        bool operator<=(const BasicIterator<OtherConst>& other) const noexcept {
+            return index_ <= other.index_;
+        }
+
+        template <bool OtherConst>
+        bool operator>=(const BasicIterator<OtherConst>& other) const noexcept {
+            return index_ >= other.index_;
+        }
+
+    private:
+        friend class SimpleVector;
+        template <bool> friend class BasicIterator;
+
+        using WordPointer = std::conditional_t<IsConst, const Word*, Word*>;
+
+        BasicIterator(WordPointer words, size_t index) noexcept
+            : words_(words), index_(index) {
+        }
+
+        WordPointer words_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    //   
+    SimpleVector() noexcept = default;
+
+    //    size ,  false
+    explicit SimpleVector(size_t size)
+        : words_(AllocateWords(WordCount(size))), size_(size), capacity_(WordCount(size) * kWordBits) {
+    }
+
+    //    size ,  value
+    SimpleVector(size_t size, bool value)
+        : SimpleVector(size) {
+        if (value) {
+            std::fill(words_.Get(), words_.Get() + WordCount(size_), ~Word(0));
+            ClearUnusedBits();
+        }
+    }
+
+    //    std::initializer_list
+    SimpleVector(std::initializer_list<bool> init)
+        : SimpleVector(init.size()) {
+        std::copy(init.begin(), init.end(), begin());
+    }
+
+    // 
+    SimpleVector(const SimpleVector& other)
+        : words_(AllocateWords(WordCount(other.capacity_))), size_(other.size_), capacity_(other.capacity_) {
+        std::copy(other.words_.Get(), other.words_.Get() + WordCount(size_), words_.Get());
+    }
+
+    // 
+    SimpleVector(SimpleVector&& other) noexcept
+        : words_(std::move(other.words_)), size_(other.size_), capacity_(other.capacity_) {
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    SimpleVector(ReserveProxyObj reserve_obj)
+        : words_(AllocateWords(WordCount(reserve_obj.Get_capacity()))),
+          capacity_(WordCount(reserve_obj.Get_capacity()) * kWordBits) {
+    }
+
+    //       
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            Reallocate(new_capacity);
+        }
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //     
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    //  -     index
+    Reference operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Reference(words_.Get() + index / kWordBits, Word(1) << (index % kWordBits));
+    }
+
+    //      index
+    bool operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return TestBit(index);
+    }
+
+    //   std::out_of_range,  index >= size
+    Reference At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Out of range");
+        }
+        return (*this)[index];
+    }
+
+    //   std::out_of_range,  index >= size
+    bool At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Out of range");
+        }
+        return TestBit(index);
+    }
+
+    //   ,    
+    void Clear() noexcept {
+        std::fill(words_.Get(), words_.Get() + WordCount(size_), Word(0));
+        size_ = 0;
+    }
+
+    //   .
+    //        false
+    void Resize(size_t new_size) {
+        if (new_size > capacity_) {
+            Reallocate(new_size * 2);
+        }
+        else if (new_size < size_) {
+            //   ,   
+            std::fill(words_.Get() + WordCount(new_size), words_.Get() + WordCount(size_), Word(0));
+            size_ = new_size;
+            ClearUnusedBits();
+        }
+        size_ = new_size;
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(words_.Get(), 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(words_.Get(), size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(words_.Get(), 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(words_.Get(), size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    //  
+    SimpleVector& operator=(const SimpleVector& rhs) {
+        if (this != &rhs) {
+            SimpleVector temp_vector(rhs);
+            swap(temp_vector);
+        }
+        return *this;
+    }
+
+    //  
+    SimpleVector& operator=(SimpleVector&& rhs) noexcept {
+        if (this != &rhs) {
+            words_ = std::move(rhs.words_);
+            size_ = std::exchange(rhs.size_, 0);
+            capacity_ = std::exchange(rhs.capacity_, 0);
+        }
+        return *this;
+    }
+
+    //     
+    //       
+    void PushBack(bool item) {
+        if (size_ == capacity_) {
+            Reallocate(capacity_ == 0 ? kWordBits : 2 * capacity_);
+        }
+        if (item) {
+            SetBit(size_);
+        }
+        ++size_;
+    }
+
+    //   value   pos.
+    //     .
+    //   pos   
+    Iterator Insert(ConstIterator pos, bool value) {
+        size_t index = pos.index_;
+        assert(index <= size_);
+
+        if (size_ == capacity_) {
+            Reallocate(capacity_ == 0 ? kWordBits : 2 * capacity_);
+        }
+        ++size_;
+
+        Word* words = words_.Get();
+        size_t first = index / kWordBits;
+        size_t offset = index % kWordBits;
+        for (size_t i = WordCount(size_) - 1; i > first; --i) {
+            words[i] = (words[i] << 1) | (words[i - 1] >> (kWordBits - 1));
+        }
+        Word low_mask = (Word(1) << offset) - 1;
+        words[first] = (words[first] & low_mask) | ((words[first] & ~low_mask) << 1);
+
+        Iterator result(words, index);
+        *result = value;
+        return result;
+    }
+
+    // ""   .     
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+        --size_;
+        ResetBit(size_);
+    }
+
+    //      .
+    //   pos   
+    Iterator Erase(ConstIterator pos) {
+        assert(!IsEmpty());
+        size_t index = pos.index_;
+        assert(index < size_);
+
+        Word* words = words_.Get();
+        size_t first = index / kWordBits;
+        size_t last = WordCount(size_) - 1;
+        Word low_mask = (Word(1) << (index % kWordBits)) - 1;
+        words[first] = (words[first] & low_mask) | ((words[first] >> 1) & ~low_mask);
+        for (size_t i = first; i < last; ++i) {
+            words[i] |= words[i + 1] << (kWordBits - 1);
+            words[i + 1] >>= 1;
+        }
+        --size_;
+
+        return Iterator(words, index);
+    }
+
+    //    
+    size_t Count() const noexcept {
+        size_t count = 0;
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            count += PopCount(words_[i]);
+        }
+        return count;
+    }
+
+    //       npos
+    size_t FindFirst() const noexcept {
+        return FindFrom(0);
+    }
+
+    //       pos  npos
+    size_t FindNext(size_t pos) const noexcept {
+        return pos >= size_ ? npos : FindFrom(pos + 1);
+    }
+
+    //      .
+    //   std::invalid_argument,   
+    SimpleVector& operator&=(const SimpleVector& rhs) {
+        CheckSameSize(rhs);
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            words_[i] &= rhs.words_[i];
+        }
+        return *this;
+    }
+
+    SimpleVector& operator|=(const SimpleVector& rhs) {
+        CheckSameSize(rhs);
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            words_[i] |= rhs.words_[i];
+        }
+        return *this;
+    }
+
+    SimpleVector& operator^=(const SimpleVector& rhs) {
+        CheckSameSize(rhs);
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            words_[i] ^= rhs.words_[i];
+        }
+        return *this;
+    }
+
+    //     
+    void swap(SimpleVector& other) noexcept {
+        words_.swap(other.words_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    //    
+    friend bool operator==(const SimpleVector& lhs, const SimpleVector& rhs) noexcept {
+        return lhs.size_ == rhs.size_
+            && std::equal(lhs.words_.Get(), lhs.words_.Get() + WordCount(lhs.size_), rhs.words_.Get());
+    }
+
+    friend bool operator!=(const SimpleVector& lhs, const SimpleVector& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+private:
+    //  ,    bits 
+    static size_t WordCount(size_t bits) noexcept {
+        return (bits + kWordBits - 1) / kWordBits;
+    }
+
+    //  word_count ,  
+    static ArrayPtr<Word> AllocateWords(size_t word_count) {
+        ArrayPtr<Word> words(word_count);
+        std::fill(words.Get(), words.Get() + word_count, Word(0));
+        return words;
+    }
+
+    static size_t PopCount(Word word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_popcountll(word));
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    //    , word    
+    static size_t CountTrailingZeros(Word word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(word));
+#else
+        return PopCount((word & (~word + 1)) - 1);
+#endif
+    }
+
+    bool TestBit(size_t index) const noexcept {
+        return ((words_[index / kWordBits] >> (index % kWordBits)) & 1u) != 0;
+    }
+
+    void SetBit(size_t index) noexcept {
+        words_[index / kWordBits] |= Word(1) << (index % kWordBits);
+    }
+
+    void ResetBit(size_t index) noexcept {
+        words_[index / kWordBits] &= ~(Word(1) << (index % kWordBits));
+    }
+
+    void CheckSameSize(const SimpleVector& other) const {
+        if (size_ != other.size_) {
+            throw std::invalid_argument("Bit vector sizes differ");
+        }
+    }
+
+    //    ,    size_
+    void ClearUnusedBits() noexcept {
+        size_t offset = size_ % kWordBits;
+        if (offset != 0) {
+            words_[size_ / kWordBits] &= (Word(1) << offset) - 1;
+        }
+    }
+
+    //         new_capacity 
+    void Reallocate(size_t new_capacity) {
+        size_t word_count = WordCount(new_capacity);
+        ArrayPtr<Word> new_words = AllocateWords(word_count);
+        std::copy(words_.Get(), words_.Get() + WordCount(size_), new_words.Get());
+        words_.swap(new_words);
+        capacity_ = word_count * kWordBits;
+    }
+
+    size_t FindFrom(size_t start) const noexcept {
+        if (start >= size_) {
+            return npos;
+        }
+        size_t i = start / kWordBits;
+        Word word = words_[i] & (~Word(0) << (start % kWordBits));
+        while (word == 0) {
+            if (++i == WordCount(size_)) {
+                return npos;
+            }
+            word = words_[i];
+        }
+        return i * kWordBits + CountTrailingZeros(word);
+    }
+
+    ArrayPtr<Word> words_;
+
+    size_t size_ = 0; //    
+    size_t capacity_ = 0; //   ,  kWordBits
+};
+
+inline SimpleVector<bool> operator&(SimpleVector<bool> lhs, const SimpleVector<bool>& rhs) {
+    lhs &= rhs;
+    return lhs;
+}
+
+inline SimpleVector<bool> operator|(SimpleVector<bool> lhs, const SimpleVector<bool>& rhs) {
+    lhs |= rhs;
+    return lhs;
+}
+
+inline SimpleVector<bool> operator^(SimpleVector<bool> lhs, const SimpleVector<bool>& rhs) {
+    lhs ^= rhs;
+    return lhs;
+}
+
 template<typename Type>
 void PrintSimpleVector(const SimpleVector<Type>& values) {
     for (auto value : values) {